@@ -0,0 +1,68 @@
+#ifndef __BOUNDED_CHANNEL_H__
+#define __BOUNDED_CHANNEL_H__
+
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+
+// 스테이지 사이를 연결하는 크기 제한 큐
+// Push 는 가득 차면 대기하고, TryPush 는 대기하지 않고 실패한다.
+template <typename T>
+class BoundedChannel {
+public:
+    explicit BoundedChannel(size_t capacity) : capacity(capacity > 0 ? capacity : 1), closed(false) {}
+
+    bool Push(T&& item) {
+        std::unique_lock<std::mutex> lock(mutex);
+        notFull.wait(lock, [this] { return queue.size() < capacity || closed; });
+        if (closed) return false;
+        queue.push_back(std::move(item));
+        notEmpty.notify_one();
+        return true;
+    }
+
+    bool TryPush(T&& item) {
+        std::unique_lock<std::mutex> lock(mutex);
+        if (closed || queue.size() >= capacity) return false;
+        queue.push_back(std::move(item));
+        notEmpty.notify_one();
+        return true;
+    }
+
+    // 닫힌 뒤 큐가 비면 false
+    bool Pop(T& item) {
+        std::unique_lock<std::mutex> lock(mutex);
+        notEmpty.wait(lock, [this] { return !queue.empty() || closed; });
+        if (queue.empty()) return false;
+        item = std::move(queue.front());
+        queue.pop_front();
+        notFull.notify_one();
+        return true;
+    }
+
+    void Close() {
+        std::unique_lock<std::mutex> lock(mutex);
+        closed = true;
+        notEmpty.notify_all();
+        notFull.notify_all();
+    }
+
+    size_t Size() {
+        std::unique_lock<std::mutex> lock(mutex);
+        return queue.size();
+    }
+
+    size_t Capacity() const {
+        return capacity;
+    }
+
+private:
+    std::mutex mutex;
+    std::condition_variable notEmpty;
+    std::condition_variable notFull;
+    std::deque<T> queue;
+    size_t capacity;
+    bool closed;
+};
+
+#endif // __BOUNDED_CHANNEL_H__
@@ -0,0 +1,232 @@
+#include <Windows.h>
+#include <iostream>
+#include <locale>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <algorithm>
+#include "Util.h"
+#include "ImageCodec.h"
+#include "PerceptualHash.h"
+#include "FramePack.h"
+#include "WorkStealingPool.h"
+
+// 캡처 디렉토리(timestamp.png)를 컨테이너로 변환하고 pHash 인덱스를 만든다.
+//   FrameIndex.exe build <capture dir> <output prefix> [workers] [frames per chunk]
+//   FrameIndex.exe query <output prefix> <image file | 0xHASH> [max distance] [limit]
+//   FrameIndex.exe extract <output prefix> <record no> <output png>
+
+static void PrintUsage(const char* program) {
+    std::wcerr << L"Usage: " << program << L" build <capture dir> <output prefix> [workers] [frames per chunk]" << std::endl;
+    std::wcerr << L"       " << program << L" query <output prefix> <image file | 0xHASH> [max distance] [limit]" << std::endl;
+    std::wcerr << L"       " << program << L" extract <output prefix> <record no> <output png>" << std::endl;
+}
+
+static int Build(const std::wstring& directory, const std::wstring& prefix, int workers, int chunkFrames) {
+    FramePack::Writer writer;
+    if (!writer.Open(prefix)) {
+        std::wcerr << L"Failed to open output: " << prefix << std::endl;
+        return 1;
+    }
+
+    auto before = std::chrono::steady_clock::now();
+    std::atomic<unsigned long long> failed(0);
+    {
+        // 청크 단위로 제출하고, 진행 중인 청크 수를 제한해서 디렉토리 크기와 상관없이 메모리를 일정하게 유지
+        WorkStealingPool pool(workers, static_cast<size_t>(workers) * 2);
+
+        auto submit = [&](std::vector<std::wstring>&& files) {
+            auto chunkFiles = std::make_shared<std::vector<std::wstring>>(std::move(files));
+            pool.Submit([&, chunkFiles] {
+                FramePack::Chunk chunk;
+                ImageCodec::Bytes current;
+                ImageCodec::Bytes previous;
+                int previousWidth = 0;
+                int previousHeight = 0;
+
+                for (const auto& file : *chunkFiles) {
+                    // 프레임 하나의 예외 (잘못된 파일명, bad_alloc 등) 로 청크 전체를 잃지 않도록 프레임마다 처리
+                    try {
+                        int width = 0;
+                        int height = 0;
+                        HRESULT hr = ImageCodec::DecodeFile(directory + L"\\" + file, current, width, height);
+                        if (FAILED(hr) || !chunk.AddFrame(Util::ToUtf8(file), current, width, height, previous, previousWidth, previousHeight)) {
+                            std::wcerr << L"Failed to convert: " << hr << L":" << file << std::endl;
+                            failed++;
+                        }
+                    } catch (const std::exception& e) {
+                        std::wcerr << L"Failed to convert: " << e.what() << L":" << file << std::endl;
+                        failed++;
+                        // 차분 기준이 어떤 상태인지 알 수 없으므로 다음 프레임은 keyframe 으로
+                        previousWidth = 0;
+                        previousHeight = 0;
+                    }
+                }
+                // 실패하면 writer 가 기억하고, 제출 루프가 멈춘 뒤 Build 가 오류로 끝난다
+                writer.Append(chunk);
+            });
+        };
+
+        // FindNextFile 은 NTFS 에서 이름순으로 나오므로 연속된 프레임이 같은 청크에 들어간다
+        WIN32_FIND_DATAW findData;
+        HANDLE hFind = FindFirstFileW((directory + L"\\*.png").c_str(), &findData);
+        if (hFind == INVALID_HANDLE_VALUE) {
+            std::wcerr << L"No png files in: " << directory << std::endl;
+            return 1;
+        }
+
+        std::vector<std::wstring> files;
+        unsigned long long submitted = 0;
+        unsigned long long nextReport = 10000;
+        do {
+            // 쓰기에 실패하면 더 제출하지 않는다
+            if (writer.Failed()) {
+                break;
+            }
+            if (findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) {
+                continue;
+            }
+            files.push_back(findData.cFileName);
+            if (static_cast<int>(files.size()) >= chunkFrames) {
+                submitted += files.size();
+                submit(std::move(files));
+                files.clear();
+                if (submitted >= nextReport) {
+                    nextReport += 10000;
+                    std::wcout << L"Submitted: " << submitted << L" frames, written: " << writer.Frames() << std::endl;
+                }
+            }
+        } while (FindNextFileW(hFind, &findData));
+        FindClose(hFind);
+
+        if (!files.empty() && !writer.Failed()) {
+            submit(std::move(files));
+        }
+        pool.Wait();
+    }
+
+    auto after = std::chrono::steady_clock::now();
+    std::chrono::duration<double> elapsed = after - before;
+    std::wcout << L"Frames: " << writer.Frames() << L" (failed " << failed.load() << L")"
+        << L", Container: " << writer.Bytes() << L" bytes"
+        << L", Time: " << elapsed.count() << L" sec" << std::endl;
+
+    if (writer.Failed()) {
+        std::wcerr << L"Failed to write output: " << prefix << std::endl;
+        return 1;
+    }
+    return failed > 0 ? 1 : 0;
+}
+
+static int Query(const std::wstring& prefix, const std::wstring& target, int maxDistance, int limit) {
+    PerceptualHash::Hash query = 0;
+    if (target.compare(0, 2, L"0x") == 0) {
+        query = wcstoull(target.c_str(), nullptr, 16);
+    } else {
+        ImageCodec::Bytes buffer;
+        int width = 0;
+        int height = 0;
+        HRESULT hr = ImageCodec::DecodeFile(target, buffer, width, height);
+        if (FAILED(hr)) {
+            std::wcerr << L"Failed to read image: " << hr << L":" << target << std::endl;
+            return 1;
+        }
+        query = PerceptualHash::Compute(buffer, width, height);
+    }
+
+    std::vector<PerceptualHash::Hash> hashes;
+    if (!FramePack::LoadHashes(prefix, hashes)) {
+        std::wcerr << L"Failed to load index: " << prefix << std::endl;
+        return 1;
+    }
+
+    auto before = std::chrono::steady_clock::now();
+    std::vector<PerceptualHash::Match> matches;
+    PerceptualHash::Search(hashes.data(), hashes.size(), query, maxDistance, matches);
+    std::sort(matches.begin(), matches.end(), [](const PerceptualHash::Match& a, const PerceptualHash::Match& b) {
+        return a.distance < b.distance || (a.distance == b.distance && a.index < b.index);
+    });
+    auto after = std::chrono::steady_clock::now();
+    std::chrono::duration<double> elapsed = after - before;
+
+    std::wcout << L"Hash: 0x" << std::hex << query << std::dec << std::endl;
+    std::wcout << L"Searched " << hashes.size() << L" frames in " << elapsed.count() * 1000.0 << L" ms, matches: " << matches.size() << std::endl;
+
+    size_t count = matches.size() < static_cast<size_t>(limit) ? matches.size() : static_cast<size_t>(limit);
+    for (size_t i = 0; i < count; ++i) {
+        FramePack::FrameRecord record;
+        if (!FramePack::LoadRecord(prefix, matches[i].index, record)) {
+            continue;
+        }
+        std::wcout << L"#" << matches[i].index << L" distance=" << matches[i].distance
+            << L" " << Util::ToWString(record.name) << L" (" << record.width << L" x " << record.height << L")" << std::endl;
+    }
+    return 0;
+}
+
+static int Extract(const std::wstring& prefix, size_t index, const std::wstring& output) {
+    FramePack::FrameRecord record;
+    if (!FramePack::LoadRecord(prefix, index, record)) {
+        std::wcerr << L"Record not found: " << index << std::endl;
+        return 1;
+    }
+
+    ImageCodec::Bytes buffer;
+    ImageCodec::Bytes encoded;
+    int width = 0;
+    int height = 0;
+    HRESULT hr = FramePack::ReadFrame(prefix, record, buffer, width, height);
+    if (SUCCEEDED(hr)) {
+        hr = ImageCodec::EncodePng(buffer, width, height, encoded);
+    }
+    if (FAILED(hr) || !ImageCodec::WriteToFile(output, encoded)) {
+        std::wcerr << L"Failed to extract: " << hr << L":" << output << std::endl;
+        return 1;
+    }
+    std::wcout << L"Extracted: " << Util::ToWString(record.name) << L" -> " << output << std::endl;
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
+
+    // 한글 출력을 위한 locale 설정
+    std::locale::global(std::locale("kor"));
+
+    if (argc < 4) {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    std::string command = argv[1];
+
+    if (command == "build") {
+        int workers = static_cast<int>(std::thread::hardware_concurrency());
+        if (argc > 4) {
+            workers = std::stoi(argv[4]);
+        }
+        int chunkFrames = 64;
+        if (argc > 5) {
+            chunkFrames = std::stoi(argv[5]);
+        }
+        std::wstring directory = Util::ToWString(argv[2]);
+        std::wstring prefix = Util::ToWString(argv[3]);
+        std::wcout << L"Build: " << directory << L" -> " << prefix << L" workers=" << workers << std::endl;
+        return Build(directory, prefix, workers < 1 ? 1 : workers, chunkFrames < 1 ? 1 : chunkFrames);
+    }
+
+    if (command == "query") {
+        int maxDistance = argc > 4 ? std::stoi(argv[4]) : 10;
+        int limit = argc > 5 ? std::stoi(argv[5]) : 20;
+        return Query(Util::ToWString(argv[2]), Util::ToWString(argv[3]), maxDistance, limit);
+    }
+
+    if (command == "extract" && argc > 4) {
+        return Extract(Util::ToWString(argv[2]), static_cast<size_t>(std::stoull(argv[3])), Util::ToWString(argv[4]));
+    }
+
+    PrintUsage(argv[0]);
+    return 1;
+}
@@ -0,0 +1,274 @@
+#ifndef __FRAME_PACK_H__
+#define __FRAME_PACK_H__
+
+#include <Windows.h>
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <mutex>
+#include <cstring>
+#include "ImageCodec.h"
+#include "PixelKernels.h"
+#include "PerceptualHash.h"
+
+// 캡처 PNG 들을 묶어 두는 컨테이너와 인덱스
+//
+// <prefix>.fpk : 컨테이너
+//   FileHeader, 그 뒤로 청크들
+//   청크 = ChunkHeader + (FrameHeader + PNG) * frameCount
+//   청크의 첫 프레임은 keyframe, 이후 프레임은 같은 크기면 직전 프레임과의 XOR 차분을 PNG 로 저장한다.
+//   (정지된 화면이 많으므로 차분은 대부분 0 이라 원본 PNG 보다 훨씬 작다)
+// <prefix>.fpi : FrameRecord 배열 (프레임 위치, 원본 파일명)
+// <prefix>.fph : PerceptualHash::Hash 배열 (.fpi 와 같은 순서)
+//
+// 청크는 끝나는 순서대로 기록되므로 레코드 순서는 원본 파일 순서와 다를 수 있다.
+namespace FramePack {
+
+#pragma pack(push, 1)
+struct FileHeader {
+    char magic[4];              // "FPK1"
+    unsigned int reserved;
+};
+
+struct ChunkHeader {
+    char magic[4];              // "FPKC"
+    unsigned int frameCount;
+    unsigned long long size;    // 헤더 뒤 바이트 수
+};
+
+struct FrameHeader {
+    unsigned int width;
+    unsigned int height;
+    unsigned int type;          // FrameKey / FrameDelta
+    unsigned int size;          // 뒤따르는 PNG 바이트 수
+};
+
+struct FrameRecord {
+    unsigned long long chunkOffset;
+    unsigned int frameIndex;    // 청크 안에서의 순서
+    unsigned int width;
+    unsigned int height;
+    char name[44];              // 원본 파일명 (UTF-8, 잘릴 수 있음)
+};
+#pragma pack(pop)
+
+enum FrameType {
+    FrameKey = 0,
+    FrameDelta = 1
+};
+
+// UTF-8 이름을 dst 에 복사 (넘치면 문자 중간이 아닌 코드 포인트 경계에서 자른다)
+inline void CopyName(char* dst, size_t capacity, const std::string& name) {
+    size_t length = name.size();
+    if (length >= capacity) {
+        length = capacity - 1;
+        // 잘리는 위치가 다음 문자의 continuation byte (10xxxxxx) 면 그 문자의 시작까지 뒤로
+        while (length > 0 && (static_cast<unsigned char>(name[length]) & 0xC0) == 0x80) {
+            length--;
+        }
+    }
+    memcpy(dst, name.data(), length);
+    dst[length] = '\0';
+}
+
+// 워커 하나가 만든 청크 (파일에 쓰기 전)
+struct Chunk {
+    ImageCodec::Bytes data;                     // FrameHeader + PNG 반복
+    std::vector<FrameRecord> records;           // chunkOffset 은 기록할 때 채운다
+    std::vector<PerceptualHash::Hash> hashes;
+
+    // 프레임 하나를 추가. previous 는 직전 프레임 (차분 계산 후 current 로 바뀜)
+    bool AddFrame(const std::string& name, ImageCodec::Bytes& current, int width, int height, ImageCodec::Bytes& previous, int& previousWidth, int& previousHeight) {
+        PerceptualHash::Hash hash = PerceptualHash::Compute(current, width, height);
+
+        FrameHeader header = { static_cast<unsigned int>(width), static_cast<unsigned int>(height), FrameKey, 0 };
+        ImageCodec::Bytes encoded;
+        HRESULT hr;
+        if (!records.empty() && width == previousWidth && height == previousHeight) {
+            // previous 를 차분으로 바꿔서 인코딩한 뒤 current 를 다음 기준으로 넘긴다
+            header.type = FrameDelta;
+            PixelKernels::XorInPlace(previous, current);
+            hr = ImageCodec::EncodePng(previous, width, height, encoded);
+        } else {
+            hr = ImageCodec::EncodePng(current, width, height, encoded);
+        }
+        previous.swap(current);
+        previousWidth = width;
+        previousHeight = height;
+        if (FAILED(hr)) {
+            // 기준 프레임이 끊겼으므로 다음 프레임은 keyframe 으로
+            previousWidth = 0;
+            previousHeight = 0;
+            return false;
+        }
+
+        header.size = static_cast<unsigned int>(encoded.size());
+
+        FrameRecord record;
+        memset(&record, 0, sizeof(record));
+        record.frameIndex = static_cast<unsigned int>(records.size());
+        record.width = header.width;
+        record.height = header.height;
+        CopyName(record.name, sizeof(record.name), name);
+
+        // 중간에 예외가 나면 (bad_alloc) 이 프레임을 모두 되돌리고, 다음 프레임은 keyframe 으로
+        size_t dataSize = data.size();
+        size_t recordCount = records.size();
+        try {
+            const unsigned char* raw = reinterpret_cast<const unsigned char*>(&header);
+            data.insert(data.end(), raw, raw + sizeof(header));
+            data.insert(data.end(), encoded.begin(), encoded.end());
+            records.push_back(record);
+            hashes.push_back(hash);
+        } catch (...) {
+            data.resize(dataSize);
+            records.resize(recordCount);
+            hashes.resize(recordCount);
+            previousWidth = 0;
+            previousHeight = 0;
+            throw;
+        }
+        return true;
+    }
+};
+
+// 여러 워커가 만든 청크를 컨테이너/인덱스 파일에 이어 붙인다.
+class Writer {
+public:
+    Writer() : offset(0), frames(0), failed(false) {}
+
+    bool Open(const std::wstring& prefix) {
+        pack.open(prefix + L".fpk", std::ios::binary | std::ios::trunc);
+        index.open(prefix + L".fpi", std::ios::binary | std::ios::trunc);
+        hashes.open(prefix + L".fph", std::ios::binary | std::ios::trunc);
+        if (!pack || !index || !hashes) {
+            return false;
+        }
+
+        FileHeader header = { { 'F', 'P', 'K', '1' }, 0 };
+        pack.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        offset = sizeof(header);
+        frames = 0;
+        failed = !pack.good();
+        return !failed;
+    }
+
+    // 한 번이라도 쓰기에 실패하면 이후 Append 는 모두 실패한다. (오프셋이 어긋난 레코드를 남기지 않도록)
+    bool Append(Chunk& chunk) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (failed) {
+            return false;
+        }
+        if (chunk.records.empty()) {
+            return true;
+        }
+
+        ChunkHeader header = { { 'F', 'P', 'K', 'C' }, static_cast<unsigned int>(chunk.records.size()), chunk.data.size() };
+        pack.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        pack.write(reinterpret_cast<const char*>(chunk.data.data()), chunk.data.size());
+
+        for (auto& record : chunk.records) {
+            record.chunkOffset = offset;
+        }
+        index.write(reinterpret_cast<const char*>(chunk.records.data()), chunk.records.size() * sizeof(FrameRecord));
+        hashes.write(reinterpret_cast<const char*>(chunk.hashes.data()), chunk.hashes.size() * sizeof(PerceptualHash::Hash));
+
+        if (!pack.good() || !index.good() || !hashes.good()) {
+            failed = true;
+            return false;
+        }
+        offset += sizeof(header) + chunk.data.size();
+        frames += chunk.records.size();
+        return true;
+    }
+
+    bool Failed() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return failed;
+    }
+
+    unsigned long long Frames() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return frames;
+    }
+
+    unsigned long long Bytes() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return offset;
+    }
+
+private:
+    std::mutex mutex;
+    std::ofstream pack;
+    std::ofstream index;
+    std::ofstream hashes;
+    unsigned long long offset;
+    unsigned long long frames;
+    bool failed;
+};
+
+// .fph 전체를 읽는다 (프레임당 8바이트)
+inline bool LoadHashes(const std::wstring& prefix, std::vector<PerceptualHash::Hash>& out) {
+    std::ifstream file(prefix + L".fph", std::ios::binary | std::ios::ate);
+    if (!file) {
+        return false;
+    }
+    std::streamoff size = file.tellg();
+    file.seekg(0);
+    out.resize(static_cast<size_t>(size / sizeof(PerceptualHash::Hash)));
+    file.read(reinterpret_cast<char*>(out.data()), out.size() * sizeof(PerceptualHash::Hash));
+    return file.good();
+}
+
+inline bool LoadRecord(const std::wstring& prefix, size_t index, FrameRecord& record) {
+    std::ifstream file(prefix + L".fpi", std::ios::binary);
+    if (!file) {
+        return false;
+    }
+    file.seekg(static_cast<std::streamoff>(index) * sizeof(FrameRecord));
+    file.read(reinterpret_cast<char*>(&record), sizeof(record));
+    return file.good();
+}
+
+// 레코드가 가리키는 프레임을 BGRA32 로 복원 (청크의 keyframe 부터 차분을 적용)
+inline HRESULT ReadFrame(const std::wstring& prefix, const FrameRecord& record, ImageCodec::Bytes& out, int& width, int& height) {
+    std::ifstream file(prefix + L".fpk", std::ios::binary);
+    if (!file) {
+        return E_FAIL;
+    }
+    file.seekg(static_cast<std::streamoff>(record.chunkOffset));
+
+    ChunkHeader chunk;
+    file.read(reinterpret_cast<char*>(&chunk), sizeof(chunk));
+    if (!file || memcmp(chunk.magic, "FPKC", 4) != 0 || record.frameIndex >= chunk.frameCount) {
+        return E_FAIL;
+    }
+
+    ImageCodec::Bytes encoded;
+    ImageCodec::Bytes decoded;
+    for (unsigned int i = 0; i <= record.frameIndex; ++i) {
+        FrameHeader header;
+        file.read(reinterpret_cast<char*>(&header), sizeof(header));
+        encoded.resize(header.size);
+        file.read(reinterpret_cast<char*>(encoded.data()), encoded.size());
+        if (!file) {
+            return E_FAIL;
+        }
+
+        HRESULT hr = ImageCodec::DecodeMemory(encoded.data(), encoded.size(), decoded, width, height);
+        if (FAILED(hr)) {
+            return hr;
+        }
+        if (header.type == FrameDelta) {
+            PixelKernels::XorInPlace(out, decoded);
+        } else {
+            out.swap(decoded);
+        }
+    }
+    return S_OK;
+}
+
+} // namespace FramePack
+
+#endif // __FRAME_PACK_H__
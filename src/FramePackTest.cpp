@@ -0,0 +1,180 @@
+#include <Windows.h>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <random>
+#include "ImageCodec.h"
+#include "PerceptualHash.h"
+#include "FramePack.h"
+
+// pHash 검색(AVX2 / scalar)과 컨테이너의 keyframe + XOR 차분 복원을 확인한다.
+//   FramePackTest.exe  (실패한 항목 수를 종료 코드로 반환)
+
+static int failures = 0;
+
+#define CHECK(expr) \
+    if (!(expr)) { \
+        std::wcerr << L"FAILED: " << #expr << L" (line " << __LINE__ << L")" << std::endl; \
+        failures++; \
+    }
+
+static bool SameMatches(const std::vector<PerceptualHash::Match>& a, const std::vector<PerceptualHash::Match>& b) {
+    if (a.size() != b.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < a.size(); ++i) {
+        if (a[i].index != b[i].index || a[i].distance != b[i].distance) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// 4 의 배수가 아닌 개수에서도 Search (AVX2 + 나머지) 와 scalar 결과가 같아야 한다
+static void TestSearch() {
+    std::wcout << L"AVX2: " << (PerceptualHash::HasAvx2() ? L"yes" : L"no") << std::endl;
+
+    std::mt19937_64 random(1234);
+    std::vector<PerceptualHash::Hash> hashes(1027);
+    for (auto& hash : hashes) {
+        hash = random();
+    }
+    PerceptualHash::Hash query = hashes[5];
+    // 거리가 작은 항목을 끝(나머지 구간)에 둔다
+    hashes[hashes.size() - 1] = query ^ 0x3;
+    hashes[hashes.size() - 2] = query ^ 0x100;
+
+    const size_t counts[] = { 0, 1, 2, 3, 4, 5, 7, 9, 13, 1026, 1027 };
+    const int distances[] = { 0, 2, 32, 64 };
+    for (size_t count : counts) {
+        for (int maxDistance : distances) {
+            std::vector<PerceptualHash::Match> fast;
+            std::vector<PerceptualHash::Match> scalar;
+            PerceptualHash::Search(hashes.data(), count, query, maxDistance, fast);
+            PerceptualHash::SearchScalar(hashes.data(), 0, count, query, maxDistance, scalar);
+            CHECK(SameMatches(fast, scalar));
+        }
+    }
+
+    std::vector<PerceptualHash::Match> matches;
+    PerceptualHash::Search(hashes.data(), hashes.size(), query, 2, matches);
+    CHECK(matches.size() == 3);
+    CHECK(matches.size() == 3 && matches[1].index == hashes.size() - 2 && matches[1].distance == 1);
+    CHECK(matches.size() == 3 && matches[2].index == hashes.size() - 1 && matches[2].distance == 2);
+}
+
+static ImageCodec::Bytes MakeFrame(int width, int height, int seed) {
+    ImageCodec::Bytes buffer(static_cast<size_t>(width) * height * 4);
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            unsigned char* px = &buffer[(static_cast<size_t>(y) * width + x) * 4];
+            px[0] = static_cast<unsigned char>(x + seed);
+            px[1] = static_cast<unsigned char>(y * 3);
+            // seed 마다 일부 영역만 바뀌도록
+            px[2] = static_cast<unsigned char>((x / 8 == seed % 4) ? 200 : x ^ y);
+            px[3] = 0xFF;
+        }
+    }
+    return buffer;
+}
+
+static std::wstring TempPrefix() {
+    wchar_t path[MAX_PATH];
+    GetTempPathW(MAX_PATH, path);
+    return std::wstring(path) + L"FramePackTest";
+}
+
+// keyframe + 차분 여러 개, 중간에 크기가 바뀌는 프레임을 넣고 모두 원본과 같게 복원되는지
+static void TestRoundTrip() {
+    struct Source {
+        int width;
+        int height;
+        int seed;
+        unsigned int type;
+    };
+    const Source sources[] = {
+        { 64, 48, 0, FramePack::FrameKey },
+        { 64, 48, 1, FramePack::FrameDelta },
+        { 64, 48, 2, FramePack::FrameDelta },
+        { 64, 48, 2, FramePack::FrameDelta },   // 같은 프레임 (차분 0)
+        { 32, 40, 3, FramePack::FrameKey },     // 크기가 바뀌면 keyframe
+        { 32, 40, 4, FramePack::FrameDelta },
+    };
+    const size_t count = sizeof(sources) / sizeof(sources[0]);
+
+    FramePack::Chunk chunk;
+    ImageCodec::Bytes previous;
+    int previousWidth = 0;
+    int previousHeight = 0;
+    for (size_t i = 0; i < count; ++i) {
+        ImageCodec::Bytes current = MakeFrame(sources[i].width, sources[i].height, sources[i].seed);
+        CHECK(chunk.AddFrame("frame" + std::to_string(i) + ".png", current, sources[i].width, sources[i].height, previous, previousWidth, previousHeight));
+    }
+    CHECK(chunk.records.size() == count);
+
+    // data 에 기록된 FrameHeader 의 종류 확인
+    size_t offset = 0;
+    for (size_t i = 0; i < count && offset + sizeof(FramePack::FrameHeader) <= chunk.data.size(); ++i) {
+        FramePack::FrameHeader header;
+        memcpy(&header, chunk.data.data() + offset, sizeof(header));
+        CHECK(header.type == sources[i].type);
+        CHECK(static_cast<int>(header.width) == sources[i].width && static_cast<int>(header.height) == sources[i].height);
+        offset += sizeof(header) + header.size;
+    }
+    CHECK(offset == chunk.data.size());
+
+    std::wstring prefix = TempPrefix();
+    {
+        FramePack::Writer writer;
+        CHECK(writer.Open(prefix));
+        CHECK(writer.Append(chunk));
+        CHECK(writer.Frames() == count);
+    }
+
+    std::vector<PerceptualHash::Hash> hashes;
+    CHECK(FramePack::LoadHashes(prefix, hashes));
+    CHECK(hashes.size() == count);
+
+    for (size_t i = 0; i < count; ++i) {
+        FramePack::FrameRecord record;
+        CHECK(FramePack::LoadRecord(prefix, i, record));
+        CHECK(record.frameIndex == i);
+        CHECK(std::string(record.name) == "frame" + std::to_string(i) + ".png");
+
+        ImageCodec::Bytes decoded;
+        int width = 0;
+        int height = 0;
+        CHECK(SUCCEEDED(FramePack::ReadFrame(prefix, record, decoded, width, height)));
+        CHECK(width == sources[i].width && height == sources[i].height);
+        CHECK(decoded == MakeFrame(sources[i].width, sources[i].height, sources[i].seed));
+    }
+
+    DeleteFileW((prefix + L".fpk").c_str());
+    DeleteFileW((prefix + L".fpi").c_str());
+    DeleteFileW((prefix + L".fph").c_str());
+}
+
+// 긴 이름은 UTF-8 문자 중간에서 잘리지 않아야 한다
+static void TestRecordName() {
+    std::string name;
+    for (int i = 0; i < 20; ++i) {
+        name += "\xED\x95\x9C";    // '한' (3 바이트)
+    }
+    char buffer[44];
+    FramePack::CopyName(buffer, sizeof(buffer), name);
+    CHECK(strlen(buffer) == 42);
+
+    FramePack::CopyName(buffer, sizeof(buffer), "short.png");
+    CHECK(std::string(buffer) == "short.png");
+}
+
+int main() {
+    TestSearch();
+    TestRoundTrip();
+    TestRecordName();
+
+    if (failures == 0) {
+        std::wcout << L"All tests passed." << std::endl;
+    }
+    return failures;
+}
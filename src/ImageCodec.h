@@ -0,0 +1,245 @@
+#ifndef __IMAGE_CODEC_H__
+#define __IMAGE_CODEC_H__
+
+#include <Windows.h>
+#include <wincodec.h>
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#pragma comment(lib, "windowscodecs.lib")
+
+// WIC 를 이용한 PNG 인코딩 / 디코딩 / 파일 쓰기
+// 여러 스레드에서 동시에 호출할 수 있도록 WIC 팩토리는 스레드별로 하나씩 만든다.
+class ImageCodec {
+public:
+    using Bytes = std::vector<unsigned char>;
+
+    // BGRA32 버퍼를 PNG 로 인코딩해서 out 에 담는다. 실패하면 step 에 실패한 단계를 기록한다.
+    static HRESULT EncodePng(const Bytes& buffer, int width, int height, Bytes& out, int* failedStep = nullptr) {
+        IWICImagingFactory* pFactory = Factory();
+        IWICBitmapEncoder* pEncoder = nullptr;
+        IWICBitmapFrameEncode* pFrameEncode = nullptr;
+        IStream* pStream = nullptr;
+        IWICBitmap* pBitmap = nullptr;
+
+        int step = 0;
+        HRESULT hr = pFactory ? S_OK : E_FAIL;
+
+        while (SUCCEEDED(hr)) {
+            step = 1;
+            hr = CreateStreamOnHGlobal(nullptr, TRUE, &pStream);
+            if (FAILED(hr)) {
+                break;
+            }
+
+            step = 2;
+            hr = pFactory->CreateEncoder(GUID_ContainerFormatPng, nullptr, &pEncoder);
+            if (FAILED(hr)) {
+                break;
+            }
+
+            step = 3;
+            hr = pEncoder->Initialize(pStream, WICBitmapEncoderNoCache);
+            if (FAILED(hr)) {
+                break;
+            }
+
+            step = 4;
+            hr = pEncoder->CreateNewFrame(&pFrameEncode, nullptr);
+            if (FAILED(hr)) {
+                break;
+            }
+
+            step = 5;
+            hr = pFrameEncode->Initialize(nullptr);
+            if (FAILED(hr)) {
+                break;
+            }
+
+            step = 6;
+            hr = pFrameEncode->SetSize(width, height);
+            if (FAILED(hr)) {
+                break;
+            }
+
+            step = 7;
+            WICPixelFormatGUID format = GUID_WICPixelFormat32bppBGRA;
+            hr = pFrameEncode->SetPixelFormat(&format);
+            if (FAILED(hr)) {
+                break;
+            }
+
+            step = 8;
+            hr = pFactory->CreateBitmapFromMemory(width, height, GUID_WICPixelFormat32bppBGRA, width * 4, static_cast<UINT>(buffer.size()), const_cast<BYTE*>(buffer.data()), &pBitmap);
+            if (FAILED(hr)) {
+                break;
+            }
+
+            step = 9;
+            hr = pFrameEncode->WriteSource(pBitmap, nullptr);
+            if (FAILED(hr)) {
+                break;
+            }
+
+            step = 10;
+            hr = pFrameEncode->Commit();
+            if (FAILED(hr)) {
+                break;
+            }
+
+            step = 11;
+            hr = pEncoder->Commit();
+            if (FAILED(hr)) {
+                break;
+            }
+
+            step = 12;
+            hr = CopyStream(pStream, out);
+            break;
+        }
+
+        if (pBitmap) pBitmap->Release();
+        if (pFrameEncode) pFrameEncode->Release();
+        if (pEncoder) pEncoder->Release();
+        if (pStream) pStream->Release();
+
+        if (failedStep) {
+            *failedStep = step;
+        }
+        return hr;
+    }
+
+    // 이미지 파일을 BGRA32 버퍼로 디코딩
+    static HRESULT DecodeFile(const std::wstring& filename, Bytes& out, int& width, int& height) {
+        IWICImagingFactory* pFactory = Factory();
+        if (!pFactory) {
+            return E_FAIL;
+        }
+
+        IWICBitmapDecoder* pDecoder = nullptr;
+        HRESULT hr = pFactory->CreateDecoderFromFilename(filename.c_str(), nullptr, GENERIC_READ, WICDecodeMetadataCacheOnDemand, &pDecoder);
+        if (FAILED(hr)) {
+            return hr;
+        }
+        hr = Decode(pFactory, pDecoder, out, width, height);
+        pDecoder->Release();
+        return hr;
+    }
+
+    // 메모리에 있는 PNG 등을 BGRA32 버퍼로 디코딩
+    static HRESULT DecodeMemory(const unsigned char* data, size_t size, Bytes& out, int& width, int& height) {
+        IWICImagingFactory* pFactory = Factory();
+        if (!pFactory) {
+            return E_FAIL;
+        }
+
+        IWICStream* pStream = nullptr;
+        IWICBitmapDecoder* pDecoder = nullptr;
+        HRESULT hr = pFactory->CreateStream(&pStream);
+        if (SUCCEEDED(hr)) {
+            hr = pStream->InitializeFromMemory(const_cast<BYTE*>(data), static_cast<DWORD>(size));
+        }
+        if (SUCCEEDED(hr)) {
+            hr = pFactory->CreateDecoderFromStream(pStream, nullptr, WICDecodeMetadataCacheOnDemand, &pDecoder);
+        }
+        if (SUCCEEDED(hr)) {
+            hr = Decode(pFactory, pDecoder, out, width, height);
+        }
+
+        if (pDecoder) pDecoder->Release();
+        if (pStream) pStream->Release();
+        return hr;
+    }
+
+    static bool WriteToFile(const std::wstring& filename, const Bytes& data) {
+        std::ofstream file(filename, std::ios::binary);
+        if (!file) {
+            return false;
+        }
+        file.write(reinterpret_cast<const char*>(data.data()), data.size());
+        return file.good();
+    }
+
+    // 현재 스레드의 WIC 팩토리 (스레드 종료 시 해제)
+    static IWICImagingFactory* Factory() {
+        static thread_local FactoryHolder holder;
+        return holder.factory;
+    }
+
+private:
+    struct FactoryHolder {
+        IWICImagingFactory* factory;
+        bool comInitialized;
+
+        FactoryHolder() : factory(nullptr), comInitialized(false) {
+            comInitialized = SUCCEEDED(CoInitializeEx(nullptr, COINIT_MULTITHREADED));
+            HRESULT hr = CoCreateInstance(CLSID_WICImagingFactory, nullptr, CLSCTX_INPROC_SERVER, IID_IWICImagingFactory, (LPVOID*)&factory);
+            if (FAILED(hr)) {
+                std::wcerr << L"Failed to create WIC factory: " << hr << std::endl;
+                factory = nullptr;
+            }
+        }
+
+        ~FactoryHolder() {
+            if (factory) factory->Release();
+            if (comInitialized) CoUninitialize();
+        }
+    };
+
+    static HRESULT Decode(IWICImagingFactory* pFactory, IWICBitmapDecoder* pDecoder, Bytes& out, int& width, int& height) {
+        IWICBitmapFrameDecode* pFrame = nullptr;
+        IWICFormatConverter* pConverter = nullptr;
+        UINT w = 0;
+        UINT h = 0;
+
+        HRESULT hr = pDecoder->GetFrame(0, &pFrame);
+        if (SUCCEEDED(hr)) {
+            hr = pFactory->CreateFormatConverter(&pConverter);
+        }
+        if (SUCCEEDED(hr)) {
+            hr = pConverter->Initialize(pFrame, GUID_WICPixelFormat32bppBGRA, WICBitmapDitherTypeNone, nullptr, 0.0, WICBitmapPaletteTypeCustom);
+        }
+        if (SUCCEEDED(hr)) {
+            hr = pConverter->GetSize(&w, &h);
+        }
+        if (SUCCEEDED(hr)) {
+            out.resize(static_cast<size_t>(w) * h * 4);
+            hr = pConverter->CopyPixels(nullptr, w * 4, static_cast<UINT>(out.size()), out.data());
+        }
+        if (SUCCEEDED(hr)) {
+            width = static_cast<int>(w);
+            height = static_cast<int>(h);
+        }
+
+        if (pConverter) pConverter->Release();
+        if (pFrame) pFrame->Release();
+        return hr;
+    }
+
+    static HRESULT CopyStream(IStream* pStream, Bytes& out) {
+        HGLOBAL hGlobal = nullptr;
+        HRESULT hr = GetHGlobalFromStream(pStream, &hGlobal);
+        if (FAILED(hr)) {
+            return hr;
+        }
+
+        STATSTG stat;
+        hr = pStream->Stat(&stat, STATFLAG_NONAME);
+        if (FAILED(hr)) {
+            return hr;
+        }
+
+        const void* data = GlobalLock(hGlobal);
+        if (data == nullptr) {
+            return E_FAIL;
+        }
+        size_t size = static_cast<size_t>(stat.cbSize.QuadPart);
+        out.assign(static_cast<const unsigned char*>(data), static_cast<const unsigned char*>(data) + size);
+        GlobalUnlock(hGlobal);
+        return S_OK;
+    }
+};
+
+#endif // __IMAGE_CODEC_H__
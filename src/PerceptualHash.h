@@ -0,0 +1,171 @@
+#ifndef __PERCEPTUAL_HASH_H__
+#define __PERCEPTUAL_HASH_H__
+
+#include <intrin.h>
+#include <immintrin.h>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include "PixelKernels.h"
+
+// 64비트 DCT 기반 perceptual hash (pHash) 와 Hamming 거리 검색
+//   32x32 휘도로 축소 -> 2D DCT -> 저주파 8x8 중 DC 를 뺀 AC 계수 63개를 중앙값과 비교해서 비트로 만든다.
+// 비슷해 보이는 프레임은 Hamming 거리가 작다. (보통 10 이하)
+class PerceptualHash {
+public:
+    using Hash = unsigned long long;
+
+    struct Match {
+        size_t index;
+        int distance;
+    };
+
+    static Hash Compute(const PixelKernels::Bytes& buffer, int width, int height) {
+        const int N = 32;
+        std::vector<float> gray;
+        PixelKernels::DownscaleGray(buffer, width, height, N, gray);
+
+        // 저주파 8x8 계수만 필요하므로 행/열 방향 모두 8개만 계산
+        const float* cosTable = CosTable();
+        float rows[N][8];
+        for (int y = 0; y < N; ++y) {
+            for (int u = 0; u < 8; ++u) {
+                float sum = 0.0f;
+                for (int x = 0; x < N; ++x) {
+                    sum += gray[y * N + x] * cosTable[u * N + x];
+                }
+                rows[y][u] = sum;
+            }
+        }
+
+        float coefficients[64];
+        for (int v = 0; v < 8; ++v) {
+            for (int u = 0; u < 8; ++u) {
+                float sum = 0.0f;
+                for (int y = 0; y < N; ++y) {
+                    sum += rows[y][u] * cosTable[v * N + y];
+                }
+                coefficients[v * 8 + u] = sum;
+            }
+        }
+
+        // DC 성분(평균 밝기)은 거의 항상 중앙값보다 커서 정보가 없으므로 버리고,
+        // AC 계수 63개만 중앙값과 비교해서 bit 0..62 를 만든다. (bit 63 은 항상 0)
+        float sorted[63];
+        std::copy(coefficients + 1, coefficients + 64, sorted);
+        std::nth_element(sorted, sorted + 31, sorted + 63);
+        float median = sorted[31];
+
+        Hash hash = 0;
+        for (int i = 1; i < 64; ++i) {
+            if (coefficients[i] > median) {
+                hash |= 1ULL << (i - 1);
+            }
+        }
+        return hash;
+    }
+
+    static int Distance(Hash a, Hash b) {
+        return PopCount(a ^ b);
+    }
+
+    // hashes 중 query 와의 거리가 maxDistance 이하인 것들을 out 에 추가
+    static void Search(const Hash* hashes, size_t count, Hash query, int maxDistance, std::vector<Match>& out) {
+        size_t i = 0;
+        if (HasAvx2()) {
+            i = SearchAvx2(hashes, count, query, maxDistance, out);
+        }
+        // AVX2 가 없거나, 4개 단위로 남은 나머지
+        SearchScalar(hashes, i, count, query, maxDistance, out);
+    }
+
+    // hashes[begin, count) 를 하나씩 비교 (테스트에서 AVX2 결과와 비교할 때도 사용)
+    static void SearchScalar(const Hash* hashes, size_t begin, size_t count, Hash query, int maxDistance, std::vector<Match>& out) {
+        for (size_t i = begin; i < count; ++i) {
+            int distance = PopCount(hashes[i] ^ query);
+            if (distance <= maxDistance) {
+                out.push_back({ i, distance });
+            }
+        }
+    }
+
+    static bool HasAvx2() {
+        static const bool supported = [] {
+            int info[4];
+            __cpuid(info, 0);
+            if (info[0] < 7) {
+                return false;
+            }
+            __cpuid(info, 1);
+            bool osxsave = (info[2] & (1 << 27)) != 0;
+            bool avx = (info[2] & (1 << 28)) != 0;
+            if (!osxsave || !avx || (_xgetbv(0) & 6) != 6) {
+                return false;
+            }
+            __cpuidex(info, 7, 0);
+            return (info[1] & (1 << 5)) != 0;
+        }();
+        return supported;
+    }
+
+private:
+    // cos((2x + 1) u pi / 2N), u < 8
+    static const float* CosTable() {
+        struct Table {
+            float values[8 * 32];
+            Table() {
+                const double pi = 3.14159265358979323846;
+                for (int u = 0; u < 8; ++u) {
+                    for (int x = 0; x < 32; ++x) {
+                        values[u * 32 + x] = static_cast<float>(cos((2 * x + 1) * u * pi / 64.0));
+                    }
+                }
+            }
+        };
+        static const Table table;
+        return table.values;
+    }
+
+    static int PopCount(Hash value) {
+        value = value - ((value >> 1) & 0x5555555555555555ULL);
+        value = (value & 0x3333333333333333ULL) + ((value >> 2) & 0x3333333333333333ULL);
+        value = (value + (value >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+        return static_cast<int>((value * 0x0101010101010101ULL) >> 56);
+    }
+
+    // 4개씩 XOR -> nibble 테이블(pshufb)로 바이트별 popcount -> sad 로 64비트 lane 별 합산
+    static size_t SearchAvx2(const Hash* hashes, size_t count, Hash query, int maxDistance, std::vector<Match>& out) {
+        const __m256i lookup = _mm256_setr_epi8(
+            0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+            0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+        const __m256i lowMask = _mm256_set1_epi8(0x0F);
+        const __m256i zero = _mm256_setzero_si256();
+        const __m256i q = _mm256_set1_epi64x(static_cast<long long>(query));
+        const __m256i limit = _mm256_set1_epi64x(maxDistance);
+
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4) {
+            __m256i x = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(hashes + i)), q);
+            __m256i lo = _mm256_shuffle_epi8(lookup, _mm256_and_si256(x, lowMask));
+            __m256i hi = _mm256_shuffle_epi8(lookup, _mm256_and_si256(_mm256_srli_epi16(x, 4), lowMask));
+            __m256i distances = _mm256_sad_epu8(_mm256_add_epi8(lo, hi), zero);
+
+            // distance > maxDistance 인 lane 은 건너뛴다
+            int overLimit = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(distances, limit)));
+            if (overLimit == 0xF) {
+                continue;
+            }
+
+            alignas(32) long long lanes[4];
+            _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), distances);
+            for (int lane = 0; lane < 4; ++lane) {
+                if ((overLimit & (1 << lane)) == 0) {
+                    out.push_back({ i + lane, static_cast<int>(lanes[lane]) });
+                }
+            }
+        }
+        return i;
+    }
+};
+
+#endif // __PERCEPTUAL_HASH_H__
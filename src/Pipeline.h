@@ -0,0 +1,274 @@
+#ifndef __PIPELINE_H__
+#define __PIPELINE_H__
+
+#include <Windows.h>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <memory>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <functional>
+#include "BoundedChannel.h"
+
+// 스테이지 하나의 실행 설정
+struct StageConfig {
+    std::wstring name;
+    int workers;
+    DWORD_PTR affinity;     // 0 이면 변경하지 않음
+    int priority;           // THREAD_PRIORITY_*
+    size_t capacity;        // 입력 채널 크기
+
+    // ini 파일의 [name] 섹션에서 설정을 읽는다. 항목이 없으면 defaults 값을 사용한다.
+    //   workers=4
+    //   affinity=0xFE
+    //   priority=highest
+    //   capacity=16
+    static StageConfig Load(const std::wstring& iniPath, const StageConfig& defaults) {
+        StageConfig config = defaults;
+        if (iniPath.empty()) {
+            return config;
+        }
+
+        const wchar_t* section = defaults.name.c_str();
+        const wchar_t* path = iniPath.c_str();
+        config.workers = GetPrivateProfileIntW(section, L"workers", defaults.workers, path);
+        config.capacity = GetPrivateProfileIntW(section, L"capacity", static_cast<int>(defaults.capacity), path);
+
+        wchar_t value[64];
+        if (GetPrivateProfileStringW(section, L"affinity", L"", value, 64, path) > 0) {
+            config.affinity = static_cast<DWORD_PTR>(wcstoull(value, nullptr, 0));
+        }
+        if (GetPrivateProfileStringW(section, L"priority", L"", value, 64, path) > 0) {
+            config.priority = ParsePriority(value, defaults.priority);
+        }
+        return config;
+    }
+
+    static int ParsePriority(const std::wstring& value, int fallback) {
+        if (value == L"idle") return THREAD_PRIORITY_IDLE;
+        if (value == L"lowest") return THREAD_PRIORITY_LOWEST;
+        if (value == L"below_normal") return THREAD_PRIORITY_BELOW_NORMAL;
+        if (value == L"normal") return THREAD_PRIORITY_NORMAL;
+        if (value == L"above_normal") return THREAD_PRIORITY_ABOVE_NORMAL;
+        if (value == L"highest") return THREAD_PRIORITY_HIGHEST;
+        if (value == L"time_critical") return THREAD_PRIORITY_TIME_CRITICAL;
+        std::wcerr << L"Unknown thread priority: " << value << std::endl;
+        return fallback;
+    }
+
+    // 이 프로세스가 사용할 수 있는 전체 코어 마스크
+    static DWORD_PTR AllCores() {
+        DWORD_PTR processMask = 0;
+        DWORD_PTR systemMask = 0;
+        GetProcessAffinityMask(GetCurrentProcess(), &processMask, &systemMask);
+        return processMask;
+    }
+};
+
+// source -> stage -> stage -> ... 로 이어지는 스테이지 파이프라인
+// 각 스테이지는 자체 스레드 풀(workers)과 입력 채널을 가지며, 스레드마다 affinity/priority 를 적용한다.
+// source 는 대기하지 않고 TryPush 로 넘기므로 뒤 스테이지가 밀려도 캡처 타이밍이 흔들리지 않는다.
+template <typename T>
+class Pipeline {
+public:
+    // false 를 반환하면 해당 항목은 다음 스테이지로 넘기지 않는다. (skipped 로 집계)
+    using StageFunc = std::function<bool(T& item)>;
+
+    class SourceContext {
+    public:
+        // 다음 스테이지가 가득 차 있으면 버리고 false
+        bool Emit(T&& item) {
+            Stage& stage = *pipeline.stages[0];
+            if (pipeline.stages.size() > 1 && !pipeline.stages[1]->input->TryPush(std::move(item))) {
+                stage.dropped++;
+                return false;
+            }
+            stage.processed++;
+            return true;
+        }
+
+        // source 가 실제로 일한 시간 (사용률 계산용)
+        void AddBusy(std::chrono::microseconds busy) {
+            pipeline.stages[0]->busyMicros += busy.count();
+        }
+
+    private:
+        friend class Pipeline;
+        explicit SourceContext(Pipeline& pipeline) : pipeline(pipeline) {}
+        Pipeline& pipeline;
+    };
+
+    // source 는 반환할 때까지 전용 스레드에서 한 번 실행된다.
+    using SourceFunc = std::function<void(SourceContext& context)>;
+
+    void SetSource(const StageConfig& config, SourceFunc func) {
+        std::unique_ptr<Stage> stage(new Stage(config));
+        if (stage->config.workers != 1) {
+            std::wcerr << L"[" << config.name << L"] source stage runs with 1 worker." << std::endl;
+            stage->config.workers = 1;
+        }
+        source = func;
+        if (stages.empty()) {
+            stages.push_back(std::move(stage));
+        } else {
+            stages[0] = std::move(stage);
+        }
+    }
+
+    void AddStage(const StageConfig& config, StageFunc func) {
+        if (stages.empty()) {
+            stages.emplace_back(nullptr);
+        }
+        std::unique_ptr<Stage> stage(new Stage(config));
+        if (stage->config.workers < 1) {
+            stage->config.workers = 1;
+        }
+        stage->func = func;
+        stage->input.reset(new BoundedChannel<T>(stage->config.capacity));
+        stages.push_back(std::move(stage));
+    }
+
+    // source 가 끝날 때까지 실행하고, 남은 항목을 모두 처리한 뒤 반환한다.
+    // reportSeconds 마다 스테이지별 사용률을 출력한다. (0 이면 출력하지 않음)
+    void Run(int reportSeconds) {
+        if (stages.empty() || !stages[0]) {
+            std::wcerr << L"Pipeline has no source stage." << std::endl;
+            return;
+        }
+
+        for (size_t i = 1; i < stages.size(); ++i) {
+            Stage& stage = *stages[i];
+            for (int w = 0; w < stage.config.workers; ++w) {
+                stage.threads.emplace_back(&Pipeline::Work, this, i);
+            }
+        }
+
+        bool sourceDone = false;
+        std::mutex doneMutex;
+        std::condition_variable doneCondition;
+
+        Stage& sourceStage = *stages[0];
+        sourceStage.threads.emplace_back([&] {
+            ApplyThreadSettings(sourceStage.config);
+            SourceContext context(*this);
+            source(context);
+            std::lock_guard<std::mutex> lock(doneMutex);
+            sourceDone = true;
+            doneCondition.notify_one();
+        });
+
+        auto lastReport = std::chrono::steady_clock::now();
+        std::vector<long long> lastBusy(stages.size(), 0);
+        {
+            std::unique_lock<std::mutex> lock(doneMutex);
+            while (!sourceDone) {
+                if (reportSeconds <= 0) {
+                    doneCondition.wait(lock, [&] { return sourceDone; });
+                    break;
+                }
+                if (!doneCondition.wait_for(lock, std::chrono::seconds(reportSeconds), [&] { return sourceDone; })) {
+                    auto now = std::chrono::steady_clock::now();
+                    Report(std::chrono::duration_cast<std::chrono::microseconds>(now - lastReport), lastBusy);
+                    lastReport = now;
+                }
+            }
+        }
+
+        // 앞 스테이지부터 차례로 닫아서 남은 항목을 흘려보낸다.
+        for (auto& stage : stages) {
+            if (stage->input) {
+                stage->input->Close();
+            }
+            for (auto& thread : stage->threads) {
+                thread.join();
+            }
+            stage->threads.clear();
+        }
+    }
+
+private:
+    struct Stage {
+        explicit Stage(const StageConfig& config) : config(config), busyMicros(0), processed(0), dropped(0), skipped(0) {}
+
+        StageConfig config;
+        StageFunc func;
+        std::unique_ptr<BoundedChannel<T>> input;
+        std::vector<std::thread> threads;
+        std::atomic<long long> busyMicros;
+        std::atomic<long long> processed;
+        std::atomic<long long> dropped;    // 채널이 가득 차서 버린 항목 (source)
+        std::atomic<long long> skipped;    // 스테이지 함수가 false 를 반환한 항목
+    };
+
+    void Work(size_t index) {
+        Stage& stage = *stages[index];
+        ApplyThreadSettings(stage.config);
+        BoundedChannel<T>* next = index + 1 < stages.size() ? stages[index + 1]->input.get() : nullptr;
+
+        T item;
+        while (stage.input->Pop(item)) {
+            auto before = std::chrono::steady_clock::now();
+            bool forward = stage.func(item);
+            auto after = std::chrono::steady_clock::now();
+            stage.busyMicros += std::chrono::duration_cast<std::chrono::microseconds>(after - before).count();
+
+            if (!forward) {
+                stage.skipped++;
+                continue;
+            }
+            stage.processed++;
+            if (next) {
+                // 다음 스테이지가 밀리면 여기서 대기 (backpressure)
+                next->Push(std::move(item));
+            }
+        }
+    }
+
+    // 스레드가 일을 시작하기 전에 자기 자신에게 적용한다.
+    static void ApplyThreadSettings(const StageConfig& config) {
+        HANDLE handle = GetCurrentThread();
+        if (config.affinity != 0) {
+            // 이 머신에 없는 코어는 빼고 적용 (남는 코어가 없으면 고정하지 않음)
+            DWORD_PTR affinity = config.affinity & StageConfig::AllCores();
+            if (affinity == 0) {
+                std::wcerr << L"[" << config.name << L"] affinity 0x" << std::hex << config.affinity << std::dec << L" has no available cores." << std::endl;
+            } else if (SetThreadAffinityMask(handle, affinity) == 0) {
+                std::wcerr << L"[" << config.name << L"] SetThreadAffinityMask failed: " << GetLastError() << std::endl;
+            }
+        }
+        if (config.priority != THREAD_PRIORITY_NORMAL && !SetThreadPriority(handle, config.priority)) {
+            std::wcerr << L"[" << config.name << L"] SetThreadPriority failed: " << GetLastError() << std::endl;
+        }
+    }
+
+    // 사용률 = 구간 동안 일한 시간 / (구간 길이 * workers)
+    void Report(std::chrono::microseconds elapsed, std::vector<long long>& lastBusy) {
+        for (size_t i = 0; i < stages.size(); ++i) {
+            Stage& stage = *stages[i];
+            long long busy = stage.busyMicros;
+            double utilization = 100.0 * (busy - lastBusy[i]) / (static_cast<double>(elapsed.count()) * stage.config.workers);
+            lastBusy[i] = busy;
+
+            std::wcout << L"[" << stage.config.name << L"] workers=" << stage.config.workers
+                << L" util=" << std::fixed << std::setprecision(1) << utilization << L"%"
+                << L" processed=" << stage.processed.load()
+                << L" dropped=" << stage.dropped.load()
+                << L" skipped=" << stage.skipped.load();
+            if (stage.input) {
+                std::wcout << L" queue=" << stage.input->Size() << L"/" << stage.input->Capacity();
+            }
+            std::wcout << std::endl;
+        }
+    }
+
+private:
+    std::vector<std::unique_ptr<Stage>> stages;    // [0] 은 source
+    SourceFunc source;
+};
+
+#endif // __PIPELINE_H__
@@ -0,0 +1,110 @@
+#ifndef __PIXEL_KERNELS_H__
+#define __PIXEL_KERNELS_H__
+
+#include <vector>
+#include <cstring>
+
+// BGRA32 버퍼를 다루는 공용 픽셀 함수들 (캡처 / 배치 변환에서 같이 사용)
+class PixelKernels {
+public:
+    using Bytes = std::vector<unsigned char>;
+
+    // 모든 픽셀이 (0, 0, 0, 0) 이면 빈 프레임
+    static bool IsEmpty(const Bytes& buffer, int width, int height) {
+        if (buffer.empty() || width <= 0 || height <= 0) {
+            return true;
+        }
+
+        // 픽셀 단위 대신 8바이트 단위로 검사
+        size_t size = static_cast<size_t>(width) * height * 4;
+        const unsigned char* data = buffer.data();
+        size_t i = 0;
+        for (; i + 8 <= size; i += 8) {
+            unsigned long long value;
+            memcpy(&value, data + i, 8);
+            if (value != 0) {
+                return false;
+            }
+        }
+        for (; i < size; ++i) {
+            if (data[i] != 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // alpha 를 모두 0xFF 로
+    static void ForceOpaque(Bytes& buffer) {
+        for (size_t i = 3; i < buffer.size(); i += 4) {
+            buffer[i] = 0xFF;
+        }
+    }
+
+    // dst ^= src (같은 크기의 프레임 사이의 차분 / 복원)
+    static void XorInPlace(Bytes& dst, const Bytes& src) {
+        size_t size = dst.size() < src.size() ? dst.size() : src.size();
+        unsigned char* d = dst.data();
+        const unsigned char* s = src.data();
+        size_t i = 0;
+        for (; i + 8 <= size; i += 8) {
+            unsigned long long a, b;
+            memcpy(&a, d + i, 8);
+            memcpy(&b, s + i, 8);
+            a ^= b;
+            memcpy(d + i, &a, 8);
+        }
+        for (; i < size; ++i) {
+            d[i] ^= s[i];
+        }
+    }
+
+    // 버퍼 전체의 64비트 digest (FNV-1a 를 8바이트 단위로 적용, 같은 프레임인지 빠르게 비교할 때 사용)
+    static unsigned long long Digest(const Bytes& buffer) {
+        const unsigned long long prime = 0x100000001B3ULL;
+        unsigned long long hash = 0xCBF29CE484222325ULL;
+        const unsigned char* data = buffer.data();
+        size_t size = buffer.size();
+        size_t i = 0;
+        for (; i + 8 <= size; i += 8) {
+            unsigned long long value;
+            memcpy(&value, data + i, 8);
+            hash = (hash ^ value) * prime;
+            hash ^= hash >> 32;
+        }
+        for (; i < size; ++i) {
+            hash = (hash ^ data[i]) * prime;
+        }
+        return hash ^ size;
+    }
+
+    // 영역 평균으로 size x size 휘도 이미지로 축소 (out 은 size * size 개)
+    static void DownscaleGray(const Bytes& buffer, int width, int height, int size, std::vector<float>& out) {
+        out.assign(static_cast<size_t>(size) * size, 0.0f);
+        if (width <= 0 || height <= 0) {
+            return;
+        }
+
+        std::vector<float> sums(out.size(), 0.0f);
+        std::vector<int> counts(out.size(), 0);
+        const unsigned char* data = buffer.data();
+        for (int y = 0; y < height; ++y) {
+            int cy = y * size / height;
+            const unsigned char* row = data + static_cast<size_t>(y) * width * 4;
+            for (int x = 0; x < width; ++x) {
+                int cx = x * size / width;
+                const unsigned char* px = row + x * 4;
+                // BT.601 luma (B, G, R 순서)
+                float luma = 0.114f * px[0] + 0.587f * px[1] + 0.299f * px[2];
+                size_t cell = static_cast<size_t>(cy) * size + cx;
+                sums[cell] += luma;
+                counts[cell]++;
+            }
+        }
+        for (size_t i = 0; i < out.size(); ++i) {
+            out[i] = counts[i] > 0 ? sums[i] / counts[i] : 0.0f;
+        }
+    }
+};
+
+#endif // __PIXEL_KERNELS_H__
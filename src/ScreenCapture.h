@@ -14,6 +14,7 @@
 #include <iomanip>
 #include <string>
 #include <functional>
+#include "PixelKernels.h"
 
 #pragma comment(lib, "d3d11.lib")
 #pragma comment(lib, "dxgi.lib")
@@ -22,9 +23,9 @@
 class ScreenCapture {
 public:
     using ImageBuffer = std::vector<unsigned char>;
-    using CaptureCallback = std::function<void(const ImageBuffer&, int, int, const std::wstring&)>;
+    using CaptureCallback = std::function<void(ImageBuffer&&, int, int, const std::wstring&)>;
 
-    ScreenCapture() : device(nullptr), context(nullptr), output(nullptr), output1(nullptr), deskDupl(nullptr), deskDuplAcquired(false), width(0), height(0), format(DXGI_FORMAT_B8G8R8A8_UNORM) {
+    ScreenCapture() : device(nullptr), context(nullptr), output(nullptr), output1(nullptr), deskDupl(nullptr), stagingTexture(nullptr), deskDuplAcquired(false), regionOutside(false), width(0), height(0), format(DXGI_FORMAT_B8G8R8A8_UNORM) {
         if (!Initialize()) {
             std::cerr << "ScreenCapture initialization failed." << std::endl;
         }
@@ -63,22 +64,34 @@ public:
         D3D11_TEXTURE2D_DESC textureDesc;
         acquiredTexture->GetDesc(&textureDesc);
 
-        ID3D11Texture2D* subResourceTexture = nullptr;
-        D3D11_TEXTURE2D_DESC subResourceTextureDesc = textureDesc;
-        subResourceTextureDesc.Width = w;
-        subResourceTextureDesc.Height = h;
-        subResourceTextureDesc.Usage = D3D11_USAGE_STAGING;
-        subResourceTextureDesc.BindFlags = 0;
-        subResourceTextureDesc.CPUAccessFlags = D3D11_CPU_ACCESS_READ;
-        subResourceTextureDesc.MiscFlags = 0;
+        // 데스크톱 밖으로 벗어난 부분은 잘라낸다. (범위를 넘으면 CopySubresourceRegion 이 아무 것도 복사하지 않음)
+        int right = x + w < (int)textureDesc.Width ? x + w : (int)textureDesc.Width;
+        int bottom = y + h < (int)textureDesc.Height ? y + h : (int)textureDesc.Height;
+        x = x > 0 ? x : 0;
+        y = y > 0 ? y : 0;
+        w = right - x;
+        h = bottom - y;
+
+        bool outside = w <= 0 || h <= 0;
+        if (outside != regionOutside) {
+            // 재시도마다 찍히지 않도록 상태가 바뀔 때만 출력
+            regionOutside = outside;
+            std::cerr << (outside ? "Capture region is outside of the desktop." : "Capture region is back on the desktop.") << std::endl;
+        }
+        if (outside) {
+            acquiredTexture->Release();
+            deskDupl->ReleaseFrame();
+            return false;
+        }
 
-        hr = device->CreateTexture2D(&subResourceTextureDesc, nullptr, &subResourceTexture);
-        if (FAILED(hr)) {
+        // staging 텍스처는 크기가 바뀔 때만 다시 만든다.
+        if (!EnsureStagingTexture(textureDesc, w, h)) {
             std::cerr << "Failed to create subresource texture." << std::endl;
             acquiredTexture->Release();
             deskDupl->ReleaseFrame();
             return false;
         }
+        ID3D11Texture2D* subResourceTexture = stagingTexture;
 
         D3D11_BOX region;
         region.left = x;
@@ -96,17 +109,19 @@ public:
         if (FAILED(hr)) {
             std::cerr << "Failed to map subresource texture." << std::endl;
             acquiredTexture->Release();
-            subResourceTexture->Release();
             deskDupl->ReleaseFrame();
             return false;
         }
 
+        // RowPitch 는 w * 4 보다 클 수 있으므로 행 단위로 복사
         ImageBuffer buffer(w * h * 4);
-        memcpy(buffer.data(), mappedResource.pData, buffer.size());
+        const unsigned char* src = static_cast<const unsigned char*>(mappedResource.pData);
+        for (int row = 0; row < h; ++row) {
+            memcpy(buffer.data() + row * w * 4, src + row * mappedResource.RowPitch, w * 4);
+        }
         context->Unmap(subResourceTexture, 0);
 
         acquiredTexture->Release();
-        subResourceTexture->Release();
         deskDupl->ReleaseFrame();
 
         if (IsFrameEmpty(buffer, w, h)) {
@@ -114,7 +129,7 @@ public:
             return false;
         }
 
-        callback(buffer, w, h, filename);
+        callback(std::move(buffer), w, h, filename);
         return true;
     }
 
@@ -170,7 +185,39 @@ private:
         return true;
     }
 
+    bool EnsureStagingTexture(const D3D11_TEXTURE2D_DESC& sourceDesc, int w, int h) {
+        if (stagingTexture && width == w && height == h && format == sourceDesc.Format) {
+            return true;
+        }
+        if (stagingTexture) {
+            stagingTexture->Release();
+            stagingTexture = nullptr;
+        }
+
+        D3D11_TEXTURE2D_DESC stagingDesc = sourceDesc;
+        stagingDesc.Width = w;
+        stagingDesc.Height = h;
+        stagingDesc.Usage = D3D11_USAGE_STAGING;
+        stagingDesc.BindFlags = 0;
+        stagingDesc.CPUAccessFlags = D3D11_CPU_ACCESS_READ;
+        stagingDesc.MiscFlags = 0;
+
+        HRESULT hr = device->CreateTexture2D(&stagingDesc, nullptr, &stagingTexture);
+        if (FAILED(hr)) {
+            stagingTexture = nullptr;
+            return false;
+        }
+        width = w;
+        height = h;
+        format = sourceDesc.Format;
+        return true;
+    }
+
     void Cleanup() {
+        if (stagingTexture) {
+            stagingTexture->Release();
+            stagingTexture = nullptr;
+        }
         if (deskDupl) {
             deskDupl->Release();
             deskDupl = nullptr;
@@ -194,31 +241,8 @@ private:
     }
 
     bool IsFrameEmpty(const ScreenCapture::ImageBuffer& buffer, int width, int height) {
-        // Check if the buffer is empty or has zero dimensions
-        if (buffer.empty() || width <= 0 || height <= 0) {
-            return true;
-        }
-    
-        // Assuming the buffer is BGRA32 format (4 bytes per pixel)
-        size_t pixelCount = width * height;
-        const unsigned char* pixelData = buffer.data();
-    
-        // Iterate through all pixels and check if they are all black (0, 0, 0, 0)
-        for (size_t i = 0; i < pixelCount; ++i) {
-            size_t pixelIndex = i * 4;
-            unsigned char blue = pixelData[pixelIndex];
-            unsigned char green = pixelData[pixelIndex + 1];
-            unsigned char red = pixelData[pixelIndex + 2];
-            unsigned char alpha = pixelData[pixelIndex + 3];
-    
-            // If any pixel is not fully transparent black, the frame is not empty
-            if (blue != 0 || green != 0 || red != 0 || alpha != 0) {
-                return false;
-            }
-        }
-    
-        // All pixels are black, so the frame is considered empty
-        return true;
+        // All pixels are transparent black, so the frame is considered empty
+        return PixelKernels::IsEmpty(buffer, width, height);
     }
 
 private:
@@ -227,7 +251,9 @@ private:
     IDXGIOutput* output;
     IDXGIOutput1* output1;
     IDXGIOutputDuplication* deskDupl;
+    ID3D11Texture2D* stagingTexture;
     bool deskDuplAcquired;
+    bool regionOutside;
     int width;
     int height;
     DXGI_FORMAT format;
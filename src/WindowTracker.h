@@ -0,0 +1,328 @@
+#ifndef __WINDOW_TRACKER_H__
+#define __WINDOW_TRACKER_H__
+
+#include <Windows.h>
+#include <iostream>
+#include <functional>
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <future>
+#include "Util.h"
+
+// 대상 창에서 발생하는 이벤트 종류
+enum class WindowEvent {
+    Moved,          // 이동 또는 크기 변경
+    Minimized,
+    Restored,
+    Destroyed
+};
+
+// 창 열거/조회/이벤트 구독 기본 함수들을 추상화한 인터페이스
+// 대상 창을 고르는 규칙은 WindowTracker 에 있고, 테스트에서는 가짜 구현으로 창 목록과 이벤트를 흉내낸다.
+class IWindowSystem {
+public:
+    using EventCallback = std::function<void(WindowEvent)>;
+
+    virtual ~IWindowSystem() {}
+
+    virtual std::vector<HWND> EnumerateWindows() = 0;
+    virtual std::wstring GetWindowTitle(HWND hwnd) = 0;
+    virtual bool IsVisible(HWND hwnd) = 0;
+    virtual DWORD GetWindowProcessId(HWND hwnd) = 0;
+    virtual DWORD GetOwnProcessId() = 0;
+    virtual bool GetClientScreenRect(HWND hwnd, RECT* rect) = 0;
+    virtual bool IsMinimized(HWND hwnd) = 0;
+
+    // hwnd 에 대한 이벤트를 callback 으로 전달 (callback 은 다른 스레드에서 호출될 수 있다)
+    virtual bool Subscribe(HWND hwnd, EventCallback callback) = 0;
+    virtual void Unsubscribe() = 0;
+};
+
+// Win32 구현 - SetWinEventHook 으로 대상 창의 이벤트만 받는다.
+class Win32WindowSystem : public IWindowSystem {
+public:
+    Win32WindowSystem() : m_hwnd(NULL), m_threadId(0) {}
+
+    ~Win32WindowSystem() {
+        Unsubscribe();
+    }
+
+    std::vector<HWND> EnumerateWindows() override {
+        std::vector<HWND> windows;
+        EnumWindows([](HWND hwnd, LPARAM lParam) -> BOOL {
+            reinterpret_cast<std::vector<HWND>*>(lParam)->push_back(hwnd);
+            return TRUE;
+        }, reinterpret_cast<LPARAM>(&windows));
+        return windows;
+    }
+
+    std::wstring GetWindowTitle(HWND hwnd) override {
+        wchar_t title[1024];
+        int len = GetWindowTextW(hwnd, title, sizeof(title)/sizeof(wchar_t));
+        return std::wstring(title, len > 0 ? len : 0);
+    }
+
+    bool IsVisible(HWND hwnd) override {
+        return IsWindowVisible(hwnd) != FALSE;
+    }
+
+    DWORD GetWindowProcessId(HWND hwnd) override {
+        DWORD pid = 0;
+        GetWindowThreadProcessId(hwnd, &pid);
+        return pid;
+    }
+
+    DWORD GetOwnProcessId() override {
+        return GetCurrentProcessId();
+    }
+
+    bool GetClientScreenRect(HWND hwnd, RECT* rect) override {
+        return Util::GetClientScreenRect(hwnd, rect);
+    }
+
+    bool IsMinimized(HWND hwnd) override {
+        return IsIconic(hwnd) != FALSE;
+    }
+
+    bool Subscribe(HWND hwnd, EventCallback callback) override {
+        Unsubscribe();
+
+        m_hwnd = hwnd;
+        m_callback = callback;
+
+        // WINEVENT_OUTOFCONTEXT 훅은 등록한 스레드의 메시지 루프로 전달되므로 전용 스레드를 둔다.
+        // 설치 결과는 promise 로 넘긴다. promise 는 훅 스레드가 소유하므로 Subscribe 가 먼저 반환해도 안전하다.
+        std::promise<bool> installed;
+        std::future<bool> result = installed.get_future();
+
+        m_thread = std::thread([this, installed = std::move(installed)]() mutable {
+            MSG msg;
+            // 메시지 큐 생성
+            PeekMessage(&msg, NULL, WM_USER, WM_USER, PM_NOREMOVE);
+            Instance() = this;
+
+            DWORD pid = 0;
+            DWORD tid = GetWindowThreadProcessId(m_hwnd, &pid);
+            DWORD flags = WINEVENT_OUTOFCONTEXT | WINEVENT_SKIPOWNPROCESS;
+            HWINEVENTHOOK hooks[] = {
+                SetWinEventHook(EVENT_OBJECT_LOCATIONCHANGE, EVENT_OBJECT_LOCATIONCHANGE, NULL, WinEventProc, pid, tid, flags),
+                SetWinEventHook(EVENT_SYSTEM_MINIMIZESTART, EVENT_SYSTEM_MINIMIZEEND, NULL, WinEventProc, pid, tid, flags),
+                SetWinEventHook(EVENT_OBJECT_DESTROY, EVENT_OBJECT_DESTROY, NULL, WinEventProc, pid, tid, flags),
+            };
+
+            bool ok = true;
+            for (auto hook : hooks) {
+                ok = ok && hook != NULL;
+            }
+
+            installed.set_value(ok);
+
+            if (ok) {
+                while (GetMessage(&msg, NULL, 0, 0) > 0) {
+                    TranslateMessage(&msg);
+                    DispatchMessage(&msg);
+                }
+            }
+
+            for (auto hook : hooks) {
+                if (hook) UnhookWinEvent(hook);
+            }
+            Instance() = nullptr;
+        });
+        m_threadId = GetThreadId(m_thread.native_handle());
+
+        if (!result.get()) {
+            std::wcerr << L"SetWinEventHook failed." << std::endl;
+            Unsubscribe();
+            return false;
+        }
+        return true;
+    }
+
+    void Unsubscribe() override {
+        if (m_thread.joinable()) {
+            PostThreadMessage(m_threadId, WM_QUIT, 0, 0);
+            m_thread.join();
+        }
+        m_threadId = 0;
+        m_hwnd = NULL;
+        m_callback = nullptr;
+    }
+
+private:
+    // WINEVENTPROC 에는 사용자 데이터가 없으므로 훅 스레드별로 인스턴스를 기억해 둔다.
+    static Win32WindowSystem*& Instance() {
+        static thread_local Win32WindowSystem* instance = nullptr;
+        return instance;
+    }
+
+    static void CALLBACK WinEventProc(HWINEVENTHOOK, DWORD event, HWND hwnd, LONG idObject, LONG idChild, DWORD, DWORD) {
+        Win32WindowSystem* self = Instance();
+        // 자식 객체(캐럿, 스크롤바 등)의 이벤트는 무시
+        if (!self || hwnd != self->m_hwnd || idObject != OBJID_WINDOW || idChild != CHILDID_SELF) {
+            return;
+        }
+
+        switch (event) {
+        case EVENT_OBJECT_LOCATIONCHANGE:
+            self->m_callback(WindowEvent::Moved);
+            break;
+        case EVENT_SYSTEM_MINIMIZESTART:
+            self->m_callback(WindowEvent::Minimized);
+            break;
+        case EVENT_SYSTEM_MINIMIZEEND:
+            self->m_callback(WindowEvent::Restored);
+            break;
+        case EVENT_OBJECT_DESTROY:
+            self->m_callback(WindowEvent::Destroyed);
+            break;
+        }
+    }
+
+private:
+    HWND m_hwnd;
+    EventCallback m_callback;
+    std::thread m_thread;
+    DWORD m_threadId;
+};
+
+// 대상 창을 한 번만 찾고 클라이언트 영역을 캐시해 두는 트래커
+// 캐시는 창 이벤트로만 갱신되고, 매 프레임에는 Current() 로 O(1) 조회한다.
+class WindowTracker {
+public:
+    struct Geometry {
+        RECT rect;
+        bool minimized;
+        bool alive;
+        unsigned int version;   // rect 가 바뀔 때마다 증가
+
+        int Width() const { return rect.right - rect.left; }
+        int Height() const { return rect.bottom - rect.top; }
+    };
+
+    explicit WindowTracker(IWindowSystem& system) : m_system(system), m_hwnd(NULL) {
+        m_geometry = { {0, 0, 0, 0}, false, false, 0 };
+    }
+
+    ~WindowTracker() {
+        Detach();
+    }
+
+    bool Attach(const wchar_t* partialTitle, const wchar_t* thisTitle) {
+        Detach();
+
+        HWND hwnd = FindTarget(partialTitle, thisTitle);
+        if (hwnd == NULL) {
+            return false;
+        }
+
+        Geometry geometry = { {0, 0, 0, 0}, m_system.IsMinimized(hwnd), true, 1 };
+        if (!m_system.GetClientScreenRect(hwnd, &geometry.rect)) {
+            return false;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_hwnd = hwnd;
+            m_geometry = geometry;
+        }
+
+        if (!m_system.Subscribe(hwnd, [this](WindowEvent event) { OnEvent(event); })) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_hwnd = NULL;
+            m_geometry.alive = false;
+            return false;
+        }
+
+        // 훅이 설치되기 전에 이동/최소화된 것은 이벤트로 오지 않으므로 한 번 더 읽는다.
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_hwnd == hwnd) {
+            m_geometry.minimized = m_system.IsMinimized(hwnd);
+            RECT rect;
+            if (!m_geometry.minimized && m_system.GetClientScreenRect(hwnd, &rect) && !SameRect(rect, m_geometry.rect)) {
+                m_geometry.rect = rect;
+                m_geometry.version++;
+            }
+        }
+        return true;
+    }
+
+    void Detach() {
+        m_system.Unsubscribe();
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_hwnd = NULL;
+        m_geometry.alive = false;
+    }
+
+    Geometry Current() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_geometry;
+    }
+
+    // 제목에 partialTitle 이 들어 있고, 보이고, 최소화되지 않은 다른 프로세스의 첫 번째 창
+    // (thisTitle 이 들어 있는 창 - 이 프로그램의 콘솔 - 은 제외)
+    HWND FindTarget(const wchar_t* partialTitle, const wchar_t* thisTitle) {
+        DWORD ownPid = m_system.GetOwnProcessId();
+        for (HWND hwnd : m_system.EnumerateWindows()) {
+            std::wstring title = m_system.GetWindowTitle(hwnd);
+            if (title.find(thisTitle) != std::wstring::npos) {
+                continue;
+            }
+            if (!m_system.IsVisible(hwnd) || m_system.GetWindowProcessId(hwnd) == ownPid) {
+                continue;
+            }
+            if (title.find(partialTitle) != std::wstring::npos && !m_system.IsMinimized(hwnd)) {
+                return hwnd;
+            }
+        }
+        return NULL;
+    }
+
+    // 이벤트 스레드에서 호출됨 (테스트에서는 직접 호출해도 된다)
+    void OnEvent(WindowEvent event) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_hwnd == NULL) {
+            return;
+        }
+
+        switch (event) {
+        case WindowEvent::Moved:
+        case WindowEvent::Restored: {
+            if (event == WindowEvent::Restored) {
+                m_geometry.minimized = false;
+            } else if (m_geometry.minimized) {
+                // 최소화 중에는 (-32000, -32000) 으로 이동하므로 무시
+                break;
+            }
+            RECT rect;
+            if (m_system.GetClientScreenRect(m_hwnd, &rect) && !SameRect(rect, m_geometry.rect)) {
+                m_geometry.rect = rect;
+                m_geometry.version++;
+            }
+            break;
+        }
+        case WindowEvent::Minimized:
+            m_geometry.minimized = true;
+            break;
+        case WindowEvent::Destroyed:
+            m_geometry.alive = false;
+            m_hwnd = NULL;
+            break;
+        }
+    }
+
+private:
+    static bool SameRect(const RECT& a, const RECT& b) {
+        return a.left == b.left && a.top == b.top && a.right == b.right && a.bottom == b.bottom;
+    }
+
+private:
+    IWindowSystem& m_system;
+    HWND m_hwnd;
+    mutable std::mutex m_mutex;
+    Geometry m_geometry;
+};
+
+#endif // __WINDOW_TRACKER_H__
@@ -0,0 +1,156 @@
+#include <Windows.h>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <map>
+#include "WindowTracker.h"
+
+// 가짜 창 시스템으로 WindowTracker 의 창 선택 규칙과 이벤트 처리를 확인한다.
+//   WindowTrackerTest.exe  (실패한 항목 수를 종료 코드로 반환)
+
+class FakeWindowSystem : public IWindowSystem {
+public:
+    struct Window {
+        std::wstring title;
+        bool visible;
+        DWORD pid;
+        bool minimized;
+        RECT rect;
+    };
+
+    std::map<HWND, Window> windows;
+    std::vector<HWND> order;
+    EventCallback callback;
+    HWND subscribed = NULL;
+    RECT moveOnSubscribe = { 0, 0, 0, 0 };  // 비어 있지 않으면 Subscribe 도중 창이 이동한 것처럼
+
+    HWND Add(const std::wstring& title, bool visible, DWORD pid, bool minimized, RECT rect) {
+        HWND hwnd = reinterpret_cast<HWND>(static_cast<INT_PTR>(order.size() + 1));
+        windows[hwnd] = { title, visible, pid, minimized, rect };
+        order.push_back(hwnd);
+        return hwnd;
+    }
+
+    void Fire(WindowEvent event) {
+        if (callback) callback(event);
+    }
+
+    std::vector<HWND> EnumerateWindows() override { return order; }
+    std::wstring GetWindowTitle(HWND hwnd) override { return windows[hwnd].title; }
+    bool IsVisible(HWND hwnd) override { return windows[hwnd].visible; }
+    DWORD GetWindowProcessId(HWND hwnd) override { return windows[hwnd].pid; }
+    DWORD GetOwnProcessId() override { return 1; }
+    bool IsMinimized(HWND hwnd) override { return windows[hwnd].minimized; }
+
+    bool GetClientScreenRect(HWND hwnd, RECT* rect) override {
+        *rect = windows[hwnd].rect;
+        return true;
+    }
+
+    bool Subscribe(HWND hwnd, EventCallback cb) override {
+        if (moveOnSubscribe.right != 0) {
+            windows[hwnd].rect = moveOnSubscribe;
+        }
+        subscribed = hwnd;
+        callback = cb;
+        return true;
+    }
+
+    void Unsubscribe() override {
+        subscribed = NULL;
+        callback = nullptr;
+    }
+};
+
+static int failures = 0;
+
+#define CHECK(expr) \
+    if (!(expr)) { \
+        std::wcerr << L"FAILED: " << #expr << L" (line " << __LINE__ << L")" << std::endl; \
+        failures++; \
+    }
+
+static void TestFindTarget() {
+    FakeWindowSystem system;
+    system.Add(L"Bubble - ScreenCapture.exe", true, 2, false, { 0, 0, 10, 10 });   // thisTitle 포함
+    system.Add(L"Bubble hidden", false, 2, false, { 0, 0, 10, 10 });               // 보이지 않음
+    system.Add(L"Bubble own", true, 1, false, { 0, 0, 10, 10 });                   // 같은 프로세스
+    system.Add(L"Bubble minimized", true, 2, true, { 0, 0, 10, 10 });              // 최소화
+    HWND target = system.Add(L"Bubble Bobble", true, 3, false, { 10, 20, 266, 244 });
+
+    WindowTracker tracker(system);
+    CHECK(tracker.Attach(L"Bubble", L"ScreenCapture.exe"));
+    CHECK(system.subscribed == target);
+
+    auto geometry = tracker.Current();
+    CHECK(geometry.alive);
+    CHECK(!geometry.minimized);
+    CHECK(geometry.Width() == 256 && geometry.Height() == 224);
+
+    WindowTracker missing(system);
+    CHECK(!missing.Attach(L"Notepad", L"ScreenCapture.exe"));
+}
+
+static void TestEvents() {
+    FakeWindowSystem system;
+    HWND target = system.Add(L"Bubble Bobble", true, 3, false, { 10, 20, 266, 244 });
+
+    WindowTracker tracker(system);
+    CHECK(tracker.Attach(L"Bubble", L"ScreenCapture.exe"));
+    unsigned int version = tracker.Current().version;
+
+    // 위치가 그대로면 version 유지
+    system.Fire(WindowEvent::Moved);
+    CHECK(tracker.Current().version == version);
+
+    system.windows[target].rect = { 100, 50, 420, 290 };
+    system.Fire(WindowEvent::Moved);
+    auto moved = tracker.Current();
+    CHECK(moved.version == version + 1);
+    CHECK(moved.rect.left == 100 && moved.Width() == 320 && moved.Height() == 240);
+
+    // 최소화 중의 이동은 무시
+    system.Fire(WindowEvent::Minimized);
+    system.windows[target].rect = { -32000, -32000, -31840, -31972 };
+    system.Fire(WindowEvent::Moved);
+    auto minimized = tracker.Current();
+    CHECK(minimized.minimized);
+    CHECK(minimized.rect.left == 100);
+
+    system.windows[target].rect = { 0, 0, 320, 240 };
+    system.Fire(WindowEvent::Restored);
+    auto restored = tracker.Current();
+    CHECK(!restored.minimized);
+    CHECK(restored.rect.left == 0 && restored.version == moved.version + 1);
+
+    system.Fire(WindowEvent::Destroyed);
+    CHECK(!tracker.Current().alive);
+
+    // 파괴 이후의 이벤트는 무시
+    system.Fire(WindowEvent::Restored);
+    CHECK(!tracker.Current().alive);
+}
+
+// 찾은 뒤 훅이 설치되기 전에 창이 이동해도 캐시에 반영되어야 한다
+static void TestMoveDuringAttach() {
+    FakeWindowSystem system;
+    system.Add(L"Bubble Bobble", true, 3, false, { 10, 20, 266, 244 });
+    system.moveOnSubscribe = { 50, 60, 370, 300 };
+
+    WindowTracker tracker(system);
+    CHECK(tracker.Attach(L"Bubble", L"ScreenCapture.exe"));
+    auto geometry = tracker.Current();
+    CHECK(geometry.rect.left == 50 && geometry.Width() == 320 && geometry.Height() == 240);
+    CHECK(geometry.version == 2);
+}
+
+int main() {
+    TestFindTarget();
+    TestEvents();
+    TestMoveDuringAttach();
+
+    if (failures == 0) {
+        std::wcout << L"All tests passed." << std::endl;
+    }
+    return failures;
+}
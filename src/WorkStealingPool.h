@@ -0,0 +1,143 @@
+#ifndef __WORK_STEALING_POOL_H__
+#define __WORK_STEALING_POOL_H__
+
+#include <iostream>
+#include <vector>
+#include <deque>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <exception>
+
+// 워커마다 자기 큐를 가지고, 자기 큐가 비면 다른 워커의 큐에서 가져오는(steal) 스레드 풀
+// 대기 중 + 실행 중인 작업이 maxPending 개를 넘으면 Submit 이 대기하므로 메모리 사용량이 제한된다.
+class WorkStealingPool {
+public:
+    using Task = std::function<void()>;
+
+    WorkStealingPool(int workers, size_t maxPending)
+        : maxPending(maxPending > 0 ? maxPending : 1), pending(0), queued(0), next(0), stopping(false) {
+        if (workers < 1) {
+            workers = 1;
+        }
+        for (int i = 0; i < workers; ++i) {
+            queues.emplace_back(new Queue());
+        }
+        for (int i = 0; i < workers; ++i) {
+            threads.emplace_back(&WorkStealingPool::Run, this, i);
+        }
+    }
+
+    ~WorkStealingPool() {
+        Wait();
+        {
+            std::lock_guard<std::mutex> lock(stateMutex);
+            stopping = true;
+        }
+        workAvailable.notify_all();
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+
+    void Submit(Task task) {
+        size_t index;
+        {
+            std::unique_lock<std::mutex> lock(stateMutex);
+            notFull.wait(lock, [this] { return pending < maxPending; });
+            pending++;
+            queued++;
+            index = next++ % queues.size();
+        }
+
+        Queue& queue = *queues[index];
+        {
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            queue.tasks.push_back(std::move(task));
+        }
+        workAvailable.notify_one();
+    }
+
+    // 제출된 작업이 모두 끝날 때까지 대기
+    void Wait() {
+        std::unique_lock<std::mutex> lock(stateMutex);
+        idle.wait(lock, [this] { return pending == 0; });
+    }
+
+    int Workers() const {
+        return static_cast<int>(queues.size());
+    }
+
+private:
+    struct Queue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    void Run(int index) {
+        while (true) {
+            Task task;
+            if (!TryPop(index, task)) {
+                std::unique_lock<std::mutex> lock(stateMutex);
+                workAvailable.wait(lock, [this] { return queued > 0 || stopping; });
+                if (stopping && queued == 0) {
+                    return;
+                }
+                continue;
+            }
+
+            try {
+                task();
+            } catch (const std::exception& e) {
+                std::wcerr << L"Task failed: " << e.what() << std::endl;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(stateMutex);
+                pending--;
+            }
+            notFull.notify_one();
+            idle.notify_all();
+        }
+    }
+
+    // 자기 큐는 뒤에서(최근 작업), 다른 큐는 앞에서(오래된 작업) 가져온다.
+    bool TryPop(int index, Task& task) {
+        size_t count = queues.size();
+        for (size_t i = 0; i < count; ++i) {
+            Queue& queue = *queues[(index + i) % count];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (queue.tasks.empty()) {
+                continue;
+            }
+            if (i == 0) {
+                task = std::move(queue.tasks.back());
+                queue.tasks.pop_back();
+            } else {
+                task = std::move(queue.tasks.front());
+                queue.tasks.pop_front();
+            }
+            std::lock_guard<std::mutex> stateLock(stateMutex);
+            queued--;
+            return true;
+        }
+        return false;
+    }
+
+private:
+    std::vector<std::unique_ptr<Queue>> queues;
+    std::vector<std::thread> threads;
+    std::mutex stateMutex;
+    std::condition_variable workAvailable;
+    std::condition_variable notFull;
+    std::condition_variable idle;
+    size_t maxPending;
+    size_t pending;     // 큐에 있거나 실행 중인 작업 수
+    size_t queued;      // 큐에 있는 작업 수
+    size_t next;
+    bool stopping;
+};
+
+#endif // __WORK_STEALING_POOL_H__
@@ -6,6 +6,14 @@ chcp 65001
 
 :::# Release 빌드
 MSBuild.exe ScreenCapture.vcxproj /p:Configuration=Release /p:Platform=Win32 
+:::# FrameIndex 는 큰 프레임을 여러 워커가 동시에 들고 있으므로 x64 로 빌드
+MSBuild.exe FrameIndex.vcxproj /p:Configuration=Release /p:Platform=x64
+
+:::# 테스트
+MSBuild.exe WindowTrackerTest.vcxproj /p:Configuration=Release /p:Platform=Win32
+Release\WindowTrackerTest.exe
+MSBuild.exe FramePackTest.vcxproj /p:Configuration=Release /p:Platform=x64
+x64\Release\FramePackTest.exe
 
 ::: Visual Studio 2022
 :::"C:\Program Files\Microsoft Visual Studio\2022\Community\MSBuild\Current\Bin\MSBuild.exe" ScreenCapture.vcxproj /p:Configuration=Debug /p:Platform=Win32
\ No newline at end of file
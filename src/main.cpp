@@ -4,9 +4,21 @@
 #include <string>
 #include <chrono>
 #include "Util.h"
+#include "WindowTracker.h"
 #include "ScreenCapture.h"
 #include "FrameRunner.h"
-#include "SaveImageThread.h"
+#include "ImageCodec.h"
+#include "PixelKernels.h"
+#include "Pipeline.h"
+
+// 파이프라인 스테이지 사이를 흐르는 프레임
+struct CaptureFrame {
+    ScreenCapture::ImageBuffer buffer;
+    int width;
+    int height;
+    std::wstring filename;
+    ImageCodec::Bytes encoded;
+};
 
 int main(int argc, char* argv[]) {
 
@@ -16,7 +28,7 @@ int main(int argc, char* argv[]) {
     std::locale::global(std::locale("kor"));
 
     if (argc < 2) {
-        std::wcerr << L"Usage: " << argv[0] << L" <window title> [frameRate]" << std::endl;
+        std::wcerr << L"Usage: " << argv[0] << L" <window title> [frameRate] [pipeline.ini]" << std::endl;
         return 1;   
     }
 
@@ -31,59 +43,150 @@ int main(int argc, char* argv[]) {
         frameRate = std::stoi(argv[2]);
     }
 
+    // argv[3] 은 스테이지 설정 파일 (GetPrivateProfile* 은 전체 경로가 필요)
+    std::wstring configPath;
+    if (argc > 3) {
+        wchar_t fullPath[MAX_PATH];
+        if (GetFullPathNameW(Util::ToWString(argv[3]).c_str(), MAX_PATH, fullPath, nullptr) > 0) {
+            configPath = fullPath;
+        }
+    }
+
     std::wcout << L"Capture Started. FPS=" << frameRate << std::endl;
     wchar_t fileName[MAX_PATH];
     
-    auto windowInfo = Util::FindTargetWindow(windowTitle.c_str(), thisTitle.c_str());
-    if (windowInfo.found) {
-        int width = windowInfo.rect.right - windowInfo.rect.left;
-        int height = windowInfo.rect.bottom - windowInfo.rect.top;
+    // 창은 한 번만 찾고, 이후 위치/크기는 창 이벤트로 갱신된 캐시에서 읽는다.
+    Win32WindowSystem windowSystem;
+    WindowTracker windowTracker(windowSystem);
+    if (windowTracker.Attach(windowTitle.c_str(), thisTitle.c_str())) {
+        auto geometry = windowTracker.Current();
+        std::wcout << "Found: (" << geometry.rect.left << ", " << geometry.rect.top << ") (" << geometry.Width() << " x " << geometry.Height() << " )" << std::endl;
+
+        // 스테이지 설정 - 캡처는 0번 코어에 높은 우선순위로, 인코더는 나머지 코어에 둔다.
+        DWORD_PTR captureCore = 0x1;
+        DWORD_PTR otherCores = StageConfig::AllCores() & ~captureCore;
+        if (otherCores == 0) {
+            otherCores = captureCore;
+        }
+        int encoders = static_cast<int>(std::thread::hardware_concurrency()) - 2;
+        if (encoders < 1) {
+            encoders = 1;
+        }
+
+        StageConfig captureConfig = StageConfig::Load(configPath, { L"capture", 1, captureCore, THREAD_PRIORITY_HIGHEST, 0 });
+        // preprocess / change 는 저장되는 파일을 바꾸므로 ini 에서 workers 를 지정할 때만 켠다.
+        StageConfig preprocessConfig = StageConfig::Load(configPath, { L"preprocess", 0, otherCores, THREAD_PRIORITY_NORMAL, 8 });
+        StageConfig changeConfig = StageConfig::Load(configPath, { L"change", 0, otherCores, THREAD_PRIORITY_NORMAL, 8 });
+        StageConfig encodeConfig = StageConfig::Load(configPath, { L"encode", encoders, otherCores, THREAD_PRIORITY_BELOW_NORMAL, 16 });
+        StageConfig writeConfig = StageConfig::Load(configPath, { L"write", 1, otherCores, THREAD_PRIORITY_BELOW_NORMAL, 16 });
+        int reportSeconds = configPath.empty() ? 5 : GetPrivateProfileIntW(L"report", L"interval", 5, configPath.c_str());
 
         ScreenCapture screenCapture;
-        SaveImageThread saveImageThread;
-
-        // Start Thread
-        saveImageThread.Start();
-
-        auto captureCallback = [&](const ScreenCapture::ImageBuffer& buffer, int width, int height, const std::wstring& filename) {
-            saveImageThread.AddImage(buffer, width, height, filename);  
-        };
-
-        std::wcout << "Found: (" << windowInfo.rect.left << ", " << windowInfo.rect.top << ") (" << width << " x " << height << " )" << std::endl;
-        try {
-            FrameRunner runner;
-            // 3프레임당 timestamp 출력
-            auto capture = [&](const wchar_t* timestamp) -> bool {
-                // Capture 에 걸린 시간 출력
-                auto before = std::chrono::system_clock::now();
-
-                // std::wcout << L"time:" << timestamp << std::endl;
-                // fileName 을 timestamp + ".png" 로 저장
-                StringCbPrintfW(fileName, sizeof(fileName), L"%s.png", timestamp);
-                auto fileNameStr = std::wstring(fileName);
-
-                for (int i = 0; i < 3; i++) {
-                    bool success = screenCapture.CaptureScreenRegion(windowInfo.rect.left, windowInfo.rect.top, width, height, fileNameStr, captureCallback);
-                    if (success) {
-                        break;
-                    }
-                    std::this_thread::sleep_for(std::chrono::microseconds(1));
-                }
+        Pipeline<CaptureFrame> pipeline;
+
+        pipeline.SetSource(captureConfig, [&](Pipeline<CaptureFrame>::SourceContext& context) {
+            auto captureCallback = [&](ScreenCapture::ImageBuffer&& buffer, int width, int height, const std::wstring& filename) {
+                CaptureFrame frame;
+                frame.buffer = std::move(buffer);
+                frame.width = width;
+                frame.height = height;
+                frame.filename = filename;
+                context.Emit(std::move(frame));
+            };
 
-                auto after = std::chrono::system_clock::now();
-                std::chrono::duration<double> elapsed = after - before;
-                std::wcout << L"Capture Time: " << elapsed.count() << L" sec" << std::endl;
+            try {
+                auto capture = [&](const wchar_t* timestamp) -> bool {
+                    // Capture 에 걸린 시간은 사용률로 집계
+                    auto before = std::chrono::steady_clock::now();
 
-                //return false; // TEST -// dont continue
+                    auto current = windowTracker.Current();
+                    if (!current.alive) {
+                        std::wcerr << L"Window closed" << std::endl;
+                        return false;
+                    }
+                    if (current.minimized) {
+                        // 최소화된 동안은 캡처하지 않는다
+                        return true;
+                    }
+                    if (current.version != geometry.version) {
+                        std::wcout << "Moved: (" << current.rect.left << ", " << current.rect.top << ") (" << current.Width() << " x " << current.Height() << " )" << std::endl;
+                    }
+                    geometry = current;
+
+                    // fileName 을 timestamp + ".png" 로 저장
+                    StringCbPrintfW(fileName, sizeof(fileName), L"%s.png", timestamp);
+                    auto fileNameStr = std::wstring(fileName);
+
+                    for (int i = 0; i < 3; i++) {
+                        bool success = screenCapture.CaptureScreenRegion(geometry.rect.left, geometry.rect.top, geometry.Width(), geometry.Height(), fileNameStr, captureCallback);
+                        if (success) {
+                            break;
+                        }
+                        std::this_thread::sleep_for(std::chrono::microseconds(1));
+                    }
+
+                    auto after = std::chrono::steady_clock::now();
+                    context.AddBusy(std::chrono::duration_cast<std::chrono::microseconds>(after - before));
+                    return true;
+                };
+                FrameRunner frameRunner;
+                frameRunner.Run(frameRate, capture);
+
+            } catch (const std::exception& e) {
+                std::wcerr << L"Error: " << e.what() << std::endl;
+            }
+        });
+
+        // workers=0 (기본값) 이면 preprocess / change 스테이지는 생략
+        if (preprocessConfig.workers > 0) {
+            pipeline.AddStage(preprocessConfig, [](CaptureFrame& frame) {
+                // Desktop Duplication 의 alpha 는 0 인 경우가 있어 PNG 가 투명해지므로 저장되는 alpha 를 0xFF 로 맞춘다
+                PixelKernels::ForceOpaque(frame.buffer);
                 return true;
-            };
-            FrameRunner frameRunner;
-            frameRunner.Run(frameRate, capture);
+            });
+        }
 
-        } catch (const std::exception& e) {
-            std::wcerr << L"Error: " << e.what() << std::endl;
+        if (changeConfig.workers > 0) {
+            // 직전 프레임과 비교해야 하므로 1개 스레드로만 실행
+            if (changeConfig.workers > 1) {
+                std::wcerr << L"[change] stage runs with 1 worker." << std::endl;
+                changeConfig.workers = 1;
+            }
+            // 직전 프레임은 복사하지 않고 digest 만 기억한다. 같은 프레임은 파일로 저장되지 않는다.
+            unsigned long long previous = 0;
+            bool hasPrevious = false;
+            pipeline.AddStage(changeConfig, [previous, hasPrevious](CaptureFrame& frame) mutable {
+                unsigned long long digest = PixelKernels::Digest(frame.buffer);
+                if (hasPrevious && digest == previous) {
+                    return false;
+                }
+                previous = digest;
+                hasPrevious = true;
+                return true;
+            });
         }
-        saveImageThread.Stop();
+
+        pipeline.AddStage(encodeConfig, [](CaptureFrame& frame) {
+            int step = 0;
+            HRESULT hr = ImageCodec::EncodePng(frame.buffer, frame.width, frame.height, frame.encoded, &step);
+            if (FAILED(hr)) {
+                std::wcerr << L"Failed to encode image: [" << step << L"] " << hr << L":" << frame.filename << std::endl;
+                return false;
+            }
+            // 인코딩된 바이트만 write 채널에 남도록 원본 버퍼를 해제
+            ScreenCapture::ImageBuffer().swap(frame.buffer);
+            return true;
+        });
+
+        pipeline.AddStage(writeConfig, [](CaptureFrame& frame) {
+            if (!ImageCodec::WriteToFile(frame.filename, frame.encoded)) {
+                std::wcerr << L"Failed to save image: " << frame.filename << std::endl;
+                return false;
+            }
+            return true;
+        });
+
+        pipeline.Run(reportSeconds);
 
     }   else {
         std::wcerr << L"Window not found" << std::endl;